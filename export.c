@@ -20,6 +20,18 @@
 
 static unsigned long blob_mark_counter;
 
+/* memoized list of commits for exporting the tip of a branch */
+struct tip_commits_memo {
+	struct tip_commits_memo *next;
+	struct rcs_number pjrev_old; /* c is zero if there was no old rev. */
+	uint32_t fingerprint; /* fingerprint of frevs */
+	const struct rcs_file_revision *frevs; /* file revisions for tip */
+	time_t date; /* tip date, used for commits with no RCS timestamp */
+	struct git_commit *commits;
+};
+
+static struct tip_commits_memo *tip_commits_memos;
+
 /* find a named project checkpoint by project revision number */
 static const char *
 pjrev_find_checkpoint(const struct rcs_number *pjrev)
@@ -540,6 +552,62 @@ get_commit_list(const struct mkssi_branch *branch,
 		new_date);
 }
 
+/* generate (or reuse) commits to move from a project revision to branch tip */
+static struct git_commit *
+get_tip_commit_list(const struct mkssi_branch *branch,
+	const struct rcs_number *pjrev_old)
+{
+	struct tip_commits_memo *m;
+	struct git_commit *c;
+
+	/*
+	 * MKSSI branches which share a revision number (or which start from the
+	 * same project revision) often have identical tips.  Building the
+	 * changeset and merging it into commits is expensive, so if we already
+	 * did that for an identical tip, reuse the result.
+	 */
+	for (m = tip_commits_memos; m; m = m->next) {
+		if (m->fingerprint != branch->tip_fingerprint
+		 || m->date != branch->mtime)
+			continue;
+		if (pjrev_old ? !rcs_number_equal(&m->pjrev_old, pjrev_old)
+		 : m->pjrev_old.c)
+			continue;
+		if (!file_revisions_equal(m->frevs, branch->tip_frevs))
+			continue;
+
+		/* The commits are identical, except for the branch. */
+		for (c = m->commits; c; c = c->next)
+			c->branch = branch->branch_name;
+		return m->commits;
+	}
+
+	m = xcalloc(1, sizeof *m, __func__);
+	if (pjrev_old)
+		m->pjrev_old = *pjrev_old;
+	m->fingerprint = branch->tip_fingerprint;
+	m->frevs = branch->tip_frevs;
+	m->date = branch->mtime;
+	m->commits = get_commit_list(branch, pjrev_old, TIP_REVNUM);
+	m->next = tip_commits_memos;
+	tip_commits_memos = m;
+	return m->commits;
+}
+
+/* free all memoized tip commit lists */
+static void
+free_tip_commits_memos(void)
+{
+	struct tip_commits_memo *m, *mnext;
+
+	for (m = tip_commits_memos; m; m = mnext) {
+		mnext = m->next;
+		free_commits(m->commits);
+		free(m);
+	}
+	tip_commits_memos = NULL;
+}
+
 /* export all changes from a given project revision onto branch */
 static void
 export_project_revision_changes(struct mkssi_branch *branch,
@@ -595,8 +663,14 @@ export_project_revision_changes(struct mkssi_branch *branch,
 		rcs_number_string_sb(pjrev_new), branch->branch_name,
 		cpname ? cpname : "<none>");
 
-	/* Build a list of commits and export them. */
-	commits = get_commit_list(branch, pjrev_old, pjrev_new);
+	/*
+	 * Build a list of commits and export them.  Commit lists for the tip
+	 * are memoized, and are freed later with the other memos.
+	 */
+	if (pjrev_new == TIP_REVNUM)
+		commits = get_tip_commit_list(branch, pjrev_old);
+	else
+		commits = get_commit_list(branch, pjrev_old, pjrev_new);
 	for (c = commits; c; c = c->next) {
 		export_commit(c);
 
@@ -604,12 +678,13 @@ export_project_revision_changes(struct mkssi_branch *branch,
 		branch->ncommit_total++; /* Total commits on branch. */
 		branch->ncommit_orig++; /* Commits original to the branch. */
 	}
-	free_commits(commits);
 
 	/* The tip has no derived branches or checkpoint. */
 	if (pjrev_new == TIP_REVNUM)
 		return;
 
+	free_commits(commits);
+
 	/*
 	 * If this project revision is the starting point for any branch(es),
 	 * create a pointer to establish the branch parentage.
@@ -686,6 +761,12 @@ export_project_branch_changes(const struct rcs_number *pjrev_start,
 		if (mkssi_proj_dir_path)
 			export_project_revision_changes(
 				mb, &pjrev_branch_old, TIP_REVNUM);
+
+		/*
+		 * No later tip export will start from pjrev_branch_old, so the
+		 * memoized commits for it are no longer useful.
+		 */
+		free_tip_commits_memos();
 	}
 
 	/*
@@ -728,6 +809,7 @@ export_project_branch_changes(const struct rcs_number *pjrev_start,
 			export_project_revision_changes(
 				mb, pjrev_start, TIP_REVNUM);
 	}
+	free_tip_commits_memos();
 }
 
 /* export git fast-import commands for all project changes */
@@ -793,6 +875,7 @@ export_project_changes(void)
 	if (!first && mkssi_proj_dir_path && !trunk_branch.c)
 		export_project_revision_changes(master_branch, &pjrev_old,
 			TIP_REVNUM);
+	free_tip_commits_memos();
 }
 
 /* tag each branch to demarcate MKSSI history from subsequent Git history */
@@ -53,6 +53,7 @@ struct mkssi_branch {
 	struct rcs_number number; /* project revision number for branch */
 	struct rcs_number tip_number; /* revision number in vpNNNN.pj */
 	const struct rcs_file_revision *tip_frevs; /* file revisions for tip */
+	uint32_t tip_fingerprint; /* fingerprint of tip_frevs */
 	unsigned long ncommit_total; /* # of commits on this branch */
 	unsigned long ncommit_orig; /* commits originating on this branch */
 	bool created; /* whether the branchpoint has been exported */
@@ -323,6 +324,8 @@ void project_read_checkpointed_revisions(void);
 void project_read_tip_revisions(void);
 const struct rcs_file_revision *find_checkpoint_file_revisions(
 	const struct rcs_number *pjrev);
+bool file_revisions_equal(const struct rcs_file_revision *a,
+	const struct rcs_file_revision *b);
 
 /* changeset.c */
 void changeset_build(const struct rcs_file_revision *old,
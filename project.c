@@ -731,6 +731,44 @@ find_checkpoint_file_revisions(const struct rcs_number *pjrev)
 	return NULL; /* unreachable */
 }
 
+/* compute a fingerprint for a list of files and their revision numbers */
+static uint32_t
+file_revisions_fingerprint(const struct rcs_file_revision *frevs)
+{
+	const struct rcs_file_revision *frev;
+	uint32_t hash;
+	short i;
+
+	/*
+	 * Combine the djb2 hash of each canonical name with its revision number
+	 * and member type.  Identical lists always produce the same value; see
+	 * file_revisions_equal() for the authoritative comparison.
+	 */
+	hash = 5381;
+	for (frev = frevs; frev; frev = frev->next) {
+		hash = (hash << 5) + hash + hash_string(frev->canonical_name);
+		for (i = 0; i < frev->rev.c; i++)
+			hash = (hash << 5) + hash + (uint32_t)frev->rev.n[i];
+		hash = (hash << 5) + hash + frev->member_type_other;
+	}
+	return hash;
+}
+
+/* whether two lists of files and their revision numbers are identical */
+bool
+file_revisions_equal(const struct rcs_file_revision *a,
+	const struct rcs_file_revision *b)
+{
+	for (; a && b; a = a->next, b = b->next) {
+		if (a->file != b->file
+		 || a->member_type_other != b->member_type_other
+		 || !rcs_number_equal(&a->rev, &b->rev)
+		 || strcmp(a->canonical_name, b->canonical_name))
+			return false;
+	}
+	return !a && !b;
+}
+
 /* parse file list and optionally branches in a revision of project.pj */
 static const struct rcs_file_revision *
 project_parse_revision(const char *pjdata, const struct rcs_number *revnum,
@@ -856,6 +894,12 @@ project_branch_read_tip_revision(struct mkssi_branch *b)
 	 */
 	b->tip_frevs = project_parse_revision(pjdata, &b->number, is_master);
 
+	/*
+	 * Fingerprint the file revisions.  Sibling branches frequently have
+	 * identical tips, and this allows the export to detect that cheaply.
+	 */
+	b->tip_fingerprint = file_revisions_fingerprint(b->tip_frevs);
+
 	/*
 	 * Save the revision number which appears in the project data for this
 	 * branch.  This is used for disambiguation when a project.pj revision